@@ -9,6 +9,7 @@ import OSLog
 /// but also exposes good patterns of accessing realm.
 class Database {
     private(set) var realm: Realm!
+    private(set) var writer: GroupedWriter!
 
     init(configuration: Realm.Configuration? = nil) throws {
         let config = try configuration ?? Database.defaultConfiguration()
@@ -18,7 +19,25 @@ class Database {
             }
         }
         try DispatchQueue.database.sync { [unowned self] in
-            realm = try Realm(configuration: config, queue: DispatchQueue.database)
+            realm = try DatabaseSignpost.interval("Open") {
+                try Realm(configuration: config, queue: DispatchQueue.database)
+            }
+        }
+        writer = GroupedWriter(realm: realm)
+    }
+}
+
+@available(iOS 13.0, *)
+extension Database {
+    /// Executes `block` in a write transaction on the database queue.
+    /// Writes requested at the same time share a single transaction,
+    /// see `GroupedWriter`.
+    /// `block` may run more than once if a write it is grouped with fails,
+    /// so it must only change the realm.
+    @discardableResult
+    func write<T>(_ block: @escaping (Realm) throws -> T) async throws -> T {
+        try await withCheckedThrowingContinuation { continuation in
+            writer.write(block) { continuation.resume(with: $0) }
         }
     }
 }
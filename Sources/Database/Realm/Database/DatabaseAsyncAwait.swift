@@ -17,12 +17,37 @@ extension Database {
         try await realm.readOptional(dbModel: DBModel.self, id: id, mapping: \.asModel)
     }
 
+    /// Reads a single page of objects mapped to domain objects
+    /// Realm results are lazy, so only objects on the requested page
+    /// are accessed and mapped, no matter how many objects match.
+    /// Returns an empty page for a negative `offset` or a non-positive `limit`.
+    func readPage<DBModel: ModelMapped>(
+        _ type: DBModel.Type,
+        where predicate: NSPredicate? = nil,
+        sortedBy sortDescriptors: [RealmSwift.SortDescriptor] = [],
+        offset: Int,
+        limit: Int
+    ) async throws -> [DBModel.Model] {
+        guard offset >= 0, limit > 0 else { return [] }
+        return try await realm.fetch { realm in
+            DatabaseSignpost.interval("Query", subject: type.className()) {
+                var results = realm.objects(type)
+                if let predicate { results = results.filter(predicate) }
+                if !sortDescriptors.isEmpty { results = results.sorted(by: sortDescriptors) }
+                let (requestedEnd, overflow) = offset.addingReportingOverflow(limit)
+                let end = overflow ? results.count : min(requestedEnd, results.count)
+                guard offset < end else { return [] }
+                return results[offset ..< end].map(\.asModel)
+            }
+        }
+    }
+
     func update<DBModel: ModelMapped>(
         _ type: DBModel.Type,
         with model: DBModel.Model
     ) async throws {
-        try await realm.update(type, id: model.id) { [realm = realm!] in
-            $0.update(with: model, realm: realm)
+        try await write { realm in
+            try realm.findObject(of: type, for: model.id).update(with: model, realm: realm)
         }
     }
 
@@ -30,8 +55,27 @@ extension Database {
         _ type: DBModel.Type,
         with model: DBModel.Model
     ) async throws {
-        try await realm.createOrUpdate(type, id: model.id) { [realm = realm!] in
-            $0.update(with: model, realm: realm)
+        try await write { realm in
+            realm.findOrCreateObject(type, id: model.id) { $0.update(with: model, realm: realm) }
+        }
+    }
+
+    /// Creates or updates all `models` in a single write transaction
+    /// Existing objects are resolved with one query up front.
+    func createOrUpdate<DBModel: ModelMapped>(
+        _ type: DBModel.Type,
+        with models: [DBModel.Model]
+    ) async throws {
+        guard !models.isEmpty else { return }
+        try await write { realm in
+            var objects = realm.findObjects(of: type, for: models.map(\.id))
+            for model in models {
+                if let object = objects[model.id] {
+                    object.update(with: model, realm: realm)
+                } else {
+                    objects[model.id] = DBModel(model: model, realm: realm)
+                }
+            }
         }
     }
 }
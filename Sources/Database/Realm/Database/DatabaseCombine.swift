@@ -10,7 +10,9 @@ extension Database {
         _ type: DBModel.Type,
         model: DBModel.Model
     ) -> Future<Void, Error> where DBModel: ModelMapped {
-        realm.create { realm in DBModel(model: model, realm: realm) }
+        Future { [self] promise in
+            writer.write({ realm in _ = DBModel(model: model, realm: realm) }, completion: promise)
+        }
     }
 
     /// Find a realm object by id and return domain object
@@ -25,9 +27,12 @@ extension Database {
     /// Observe changes of object with id
     /// This will observe all changes on a realm object
     /// and publish mapped domain objects
+    /// Pass `coalescingInterval` to publish at most once per interval
+    /// when many commits change the object in a short time.
     func observe<DBModel: Object, Model>(
         dbModel type: DBModel.Type,
         id: String,
+        coalescingInterval: DispatchQueue.SchedulerTimeType.Stride? = nil,
         mapping: @escaping (DBModel) -> Model
     ) -> some Publisher<Model, Never> {
         realm.read(dbModel: type, id: id)
@@ -35,7 +40,10 @@ extension Database {
             .flatMap { object in
                 valuePublisher(object)
                     .prepend(object)
-                    .map(mapping)
+                    .coalesced(by: coalescingInterval)
+                    .map { object in
+                        DatabaseSignpost.interval("Notify", subject: type.className()) { mapping(object) }
+                    }
             }
             .assertNoFailure()
     }
@@ -43,10 +51,13 @@ extension Database {
     /// Observe changes of object with id
     /// This will observe changes on a realm object at key path
     /// and publish mapped domain objects
+    /// Pass `coalescingInterval` to publish at most once per interval
+    /// when many commits change the object in a short time.
     func observe<DBModel: Object, Model, Value>(
         dbModel type: DBModel.Type,
         id: String,
         keyPath: KeyPath<DBModel, Value>,
+        coalescingInterval: DispatchQueue.SchedulerTimeType.Stride? = nil,
         mapping: @escaping (Value) -> Model
     ) -> some Publisher<Model, Never> {
         realm.read(dbModel: type, id: id, mapping: { $0 })
@@ -54,7 +65,12 @@ extension Database {
             .flatMap { object in
                 valuePublisher(object, keyPaths: [_name(for: keyPath)])
                     .prepend(object)
-                    .map { mapping($0[keyPath: keyPath]) }
+                    .coalesced(by: coalescingInterval)
+                    .map { object in
+                        DatabaseSignpost.interval("Notify", subject: type.className()) {
+                            mapping(object[keyPath: keyPath])
+                        }
+                    }
             }
             .assertNoFailure()
     }
@@ -63,13 +79,35 @@ extension Database {
         _ type: DBModel.Type,
         with model: DBModel.Model
     ) -> ThrowingTaskPublisher<Void> {
-        realm.update(DBModel.self, id: model.id) { [realm = realm!] object in object.update(with: model, realm: realm) }
+        ThrowingTaskPublisher { [self] in
+            try await self.write { realm in
+                try realm.findObject(of: type, for: model.id).update(with: model, realm: realm)
+            }
+        }
     }
 
     func createOrUpdate<DBModel: ModelMapped>(
         _ type: DBModel.Type,
         with model: DBModel.Model
     ) -> ThrowingTaskPublisher<Void> {
-        realm.createOrUpdate(DBModel.self, id: model.id) { [realm = realm!] object in object.update(with: model, realm: realm) }
+        ThrowingTaskPublisher { [self] in
+            try await self.write { realm in
+                realm.findOrCreateObject(type, id: model.id) { $0.update(with: model, realm: realm) }
+            }
+        }
+    }
+}
+
+@available(iOS 13.0, *)
+private extension Publisher where Output: Object {
+    /// Publishes only the latest value once per `interval`
+    /// Realm objects are live, so the latest value reflects all skipped changes.
+    /// The object can be deleted while it waits for the interval to pass,
+    /// so invalidated objects are dropped instead of being published.
+    func coalesced(by interval: DispatchQueue.SchedulerTimeType.Stride?) -> AnyPublisher<Output, Failure> {
+        guard let interval else { return eraseToAnyPublisher() }
+        return throttle(for: interval, scheduler: DispatchQueue.database, latest: true)
+            .filter { !$0.isInvalidated }
+            .eraseToAnyPublisher()
     }
 }
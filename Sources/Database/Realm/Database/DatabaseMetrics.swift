@@ -0,0 +1,90 @@
+import Foundation
+
+/// Latency histograms for database operations
+/// Every `DatabaseSignpost` interval is recorded here under its name,
+/// e.g. "Grouped write" for the block work and commit, "Commit" for the commit and sync alone,
+/// or per model type, e.g. "Read UserDB", "Query UserDB" or "Notify UserDB".
+/// Recording takes a lock and a dictionary lookup by operation name on top of
+/// a constant time histogram update, cheap enough to stay on in production.
+final class DatabaseMetrics {
+    static let shared = DatabaseMetrics()
+
+    private let lock = NSLock()
+    private var histograms: [String: LatencyHistogram] = [:]
+
+    func record(_ operation: String, nanoseconds: UInt64) {
+        lock.lock()
+        defer { lock.unlock() }
+        histograms[operation, default: LatencyHistogram()].record(nanoseconds: nanoseconds)
+    }
+
+    /// Percentiles of every operation recorded so far
+    func snapshot() -> [String: LatencyHistogram.Snapshot] {
+        lock.lock()
+        defer { lock.unlock() }
+        return histograms.mapValues(\.snapshot)
+    }
+
+    func reset() {
+        lock.lock()
+        defer { lock.unlock() }
+        histograms.removeAll()
+    }
+}
+
+/// Log-bucketed histogram of durations with nanosecond resolution
+/// Every power of two is split into 8 linear sub-buckets, so the
+/// reported percentiles are within 12.5% of the recorded values.
+struct LatencyHistogram {
+    struct Snapshot: Equatable {
+        let count: UInt64
+        let p50: TimeInterval
+        let p99: TimeInterval
+        let p999: TimeInterval
+    }
+
+    private static let subBucketBits = 3
+    private static let subBucketCount = 1 << subBucketBits
+
+    private(set) var count: UInt64 = 0
+    private var buckets = [UInt64](repeating: 0, count: (64 - subBucketBits + 1) * subBucketCount)
+
+    mutating func record(nanoseconds: UInt64) {
+        buckets[Self.bucket(for: nanoseconds)] += 1
+        count += 1
+    }
+
+    /// Upper bound of the bucket containing the `fraction` percentile, in seconds
+    func percentile(_ fraction: Double) -> TimeInterval {
+        guard count > 0 else { return 0 }
+        let rank = max(1, UInt64((fraction * Double(count)).rounded(.up)))
+        var seen: UInt64 = 0
+        for (bucket, bucketCount) in buckets.enumerated() {
+            seen += bucketCount
+            if seen >= rank { return TimeInterval(Self.upperBound(of: bucket)) / 1_000_000_000 }
+        }
+        return TimeInterval(Self.upperBound(of: buckets.count - 1)) / 1_000_000_000
+    }
+
+    var snapshot: Snapshot {
+        Snapshot(count: count, p50: percentile(0.5), p99: percentile(0.99), p999: percentile(0.999))
+    }
+}
+
+private extension LatencyHistogram {
+    static func bucket(for nanoseconds: UInt64) -> Int {
+        guard nanoseconds >= subBucketCount else { return Int(nanoseconds) }
+        let exponent = 63 - nanoseconds.leadingZeroBitCount
+        let shift = exponent - subBucketBits
+        let subBucket = Int(nanoseconds >> shift) & (subBucketCount - 1)
+        return (shift + 1) * subBucketCount + subBucket
+    }
+
+    static func upperBound(of bucket: Int) -> UInt64 {
+        guard bucket >= subBucketCount else { return UInt64(bucket) }
+        let shift = bucket / subBucketCount - 1
+        let subBucket = UInt64(bucket % subBucketCount)
+        let lowerBound = (UInt64(subBucketCount) + subBucket) << shift
+        return lowerBound + ((1 << shift) - 1)
+    }
+}
@@ -0,0 +1,30 @@
+import Foundation
+import OSLog
+
+/// Signpost intervals around database work
+/// They show up under Points of Interest when profiling with Instruments.
+/// Signposts are close to free while nothing is recording them.
+/// Durations are recorded to `DatabaseMetrics` as well,
+/// under `name` followed by `subject`, e.g. "Read UserDB".
+enum DatabaseSignpost {
+    private static let log = OSLog(subsystem: "com.infinum.Realm", category: "PointsOfInterest")
+
+    static func interval<T>(
+        _ name: StaticString,
+        subject: String? = nil,
+        _ work: () throws -> T
+    ) rethrows -> T {
+        let start = DispatchTime.now().uptimeNanoseconds
+        defer {
+            let operation = subject.map { "\(name) \($0)" } ?? name.description
+            DatabaseMetrics.shared.record(operation, nanoseconds: DispatchTime.now().uptimeNanoseconds - start)
+        }
+        if #available(iOS 12.0, *) {
+            let id = OSSignpostID(log: log)
+            os_signpost(.begin, log: log, name: name, signpostID: id, "%{public}@", subject ?? "")
+            defer { os_signpost(.end, log: log, name: name, signpostID: id) }
+            return try work()
+        }
+        return try work()
+    }
+}
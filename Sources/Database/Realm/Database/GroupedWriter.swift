@@ -0,0 +1,88 @@
+import Foundation
+import RealmSwift
+
+/// Coalesces writes queued close together into a single Realm write transaction.
+/// Every `realm.write` ends with its own commit and sync to disk,
+/// so many small writes are bound by that sync rather than by the work itself.
+/// Writes that are queued while a commit is already scheduled are committed
+/// together and all of their callers are completed once the commit is done.
+final class GroupedWriter {
+    private struct PendingWrite {
+        let perform: (Realm) throws -> Void
+        let complete: (Error?) -> Void
+    }
+
+    private let realm: Realm
+    private let queue: DispatchQueue
+    // Only accessed on `queue`
+    private var pending: [PendingWrite] = []
+    private var isCommitScheduled = false
+
+    init(realm: Realm, queue: DispatchQueue = .database) {
+        self.realm = realm
+        self.queue = queue
+    }
+
+    /// Queues `block` to be executed in the next grouped write transaction.
+    /// `completion` is called on `queue` after the transaction has been committed.
+    /// If another write in the same transaction fails, the transaction is rolled back
+    /// and the remaining writes are committed together without it,
+    /// so `block` may run more than once.
+    /// It must only change the realm and have no other side effects.
+    func write<T>(
+        _ block: @escaping (Realm) throws -> T,
+        completion: @escaping (Result<T, Error>) -> Void
+    ) {
+        var value: T?
+        let write = PendingWrite(
+            perform: { value = try block($0) },
+            complete: { error in completion(error.map { .failure($0) } ?? .success(value!)) }
+        )
+        queue.async { [self] in
+            pending.append(write)
+            guard !isCommitScheduled else { return }
+            isCommitScheduled = true
+            // Scheduled behind every write already waiting on the queue,
+            // so all of them end up in the same transaction
+            queue.async { self.commit() }
+        }
+    }
+}
+
+private extension GroupedWriter {
+    func commit() {
+        var batch = pending
+        pending.removeAll()
+        isCommitScheduled = false
+
+        while !batch.isEmpty {
+            var failure: (index: Int, error: Error)?
+            do {
+                try DatabaseSignpost.interval("Grouped write") {
+                    realm.beginWrite()
+                    for (index, write) in batch.enumerated() {
+                        do {
+                            try write.perform(realm)
+                        } catch {
+                            failure = (index, error)
+                            realm.cancelWrite()
+                            return
+                        }
+                    }
+                    try DatabaseSignpost.interval("Commit") { try realm.commitWrite() }
+                }
+            } catch {
+                if realm.isInWriteTransaction { realm.cancelWrite() }
+                batch.forEach { $0.complete(error) }
+                return
+            }
+            guard let failure else {
+                batch.forEach { $0.complete(nil) }
+                return
+            }
+            // A failing write rolls back the whole transaction.
+            // Fail only that write and commit the rest together again.
+            batch.remove(at: failure.index).complete(failure.error)
+        }
+    }
+}
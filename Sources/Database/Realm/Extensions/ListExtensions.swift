@@ -6,11 +6,24 @@ extension List {
         append(objectsIn: sequence)
     }
 
+    /// Removes the first occurrence of each of `items`
+    /// Looks up all items in a single pass over the list, which stops
+    /// as soon as every item is found, instead of searching the list again for every item.
     func remove(items: some Sequence<Element>) {
-        for item in items {
-            if let index = firstIndex(of: item) {
-                remove(at: index)
-            }
+        var remaining = items.reduce(into: [Element: Int]()) { $0[$1, default: 0] += 1 }
+        var offsets = IndexSet()
+        for (offset, element) in enumerated() {
+            if remaining.isEmpty { break }
+            guard let count = remaining[element] else { continue }
+            offsets.insert(offset)
+            remaining[element] = count > 1 ? count - 1 : nil
         }
+        remove(atOffsets: offsets)
+    }
+
+    /// Replaces the contents of the list with `sequence`
+    func assign(_ sequence: some Sequence<Element>) {
+        removeAll()
+        append(objectsIn: sequence)
     }
 }
@@ -20,6 +20,19 @@ extension Realm {
         return object
     }
 
+    /// Resolves objects for all `ids` with a single query
+    func findObjects<T: Object, KeyType: Hashable>(
+        of type: T.Type,
+        for ids: [KeyType]
+    ) -> [KeyType: T] {
+        guard let primaryKey = schema[T.className()]?.primaryKeyProperty?.name else { return [:] }
+        let matches = objects(type).filter("%K IN %@", primaryKey, ids)
+        return Dictionary(
+            matches.compactMap { object in (object.value(forKey: primaryKey) as? KeyType).map { ($0, object) } },
+            uniquingKeysWith: { first, _ in first }
+        )
+    }
+
     func findOrCreateObject<DBModel: Object, KeyType>(
         _ type: DBModel.Type,
         id: KeyType,
@@ -43,7 +56,7 @@ extension Realm {
         try await withCheckedThrowingContinuation { (continuation: CheckedContinuation<T, Swift.Error>) in
             DispatchQueue.database.async {
                 do {
-                    let response = try block(self)
+                    let response = try DatabaseSignpost.interval("Execute") { try block(self) }
                     continuation.resume(with: .success(response))
                 } catch {
                     continuation.resume(with: .failure(error))
@@ -72,7 +85,9 @@ extension Realm {
         mapping: @escaping (DBModel) -> Model
     ) async throws -> Model {
         try await fetch { _ in
-            try mapping(findObject(of: type, for: id))
+            try DatabaseSignpost.interval("Read", subject: type.className()) {
+                try mapping(findObject(of: type, for: id))
+            }
         }
     }
 
@@ -82,8 +97,10 @@ extension Realm {
         mapping: @escaping (DBModel) -> Model
     ) async throws -> Model? {
         try await fetch { _ in
-            guard let object = object(ofType: type, forPrimaryKey: id) else { return nil }
-            return mapping(object)
+            try DatabaseSignpost.interval("Read", subject: type.className()) {
+                guard let object = object(ofType: type, forPrimaryKey: id) else { return nil }
+                return mapping(object)
+            }
         }
     }
 
@@ -9,7 +9,11 @@ extension Realm {
         mapping: @escaping (DBModel) -> Model
     ) -> Future<Model, Swift.Error> {
         DispatchQueue.database.asyncFuture { promise in
-            promise(.init(catching: { try mapping(findObject(of: type, for: id)) }))
+            promise(.init(catching: {
+                try DatabaseSignpost.interval("Read", subject: type.className()) {
+                    try mapping(findObject(of: type, for: id))
+                }
+            }))
         }
     }
 
@@ -25,9 +29,11 @@ extension Realm {
     ) -> Future<Void, Swift.Error> {
         return DispatchQueue.database.asyncFuture { promise in
             do {
-                try write {
-                    let object = createBlock(self)
-                    add(object)
+                try DatabaseSignpost.interval("Create", subject: DBModel.className()) {
+                    try write {
+                        let object = createBlock(self)
+                        add(object)
+                    }
                 }
                 promise(.success(()))
             } catch {
@@ -0,0 +1,66 @@
+import Foundation
+import RealmSwift
+
+/// Binary value that is stored compressed in Realm
+/// Use it for `Data` properties holding large, compressible blobs:
+/// `@Persisted var payload: CompressedData`
+/// Values are compressed with LZFSE on write and decompressed on read.
+/// Stored values start with a magic header followed by a format byte,
+/// so small or incompressible values are kept as they are.
+/// Bytes without the header are read as they are, which means an existing
+/// `Data` column can switch to `CompressedData` without a migration.
+@available(iOS 13.0, *)
+struct CompressedData: Equatable {
+    /// Values smaller than this are not worth compressing
+    static let compressionThreshold = 1024
+
+    let data: Data
+
+    init(_ data: Data) {
+        self.data = data
+    }
+}
+
+@available(iOS 13.0, *)
+extension CompressedData: CustomPersistable {
+    typealias PersistedType = Data
+
+    private static let magic = Data("RLMZ".utf8)
+
+    private enum Format: UInt8 {
+        case raw
+        case lzfse
+    }
+
+    init(persistedValue: Data) {
+        let header = Self.magic.count + 1
+        guard persistedValue.count >= header, persistedValue.starts(with: Self.magic) else {
+            // Untagged, e.g. written before the property was compressed
+            self.init(persistedValue)
+            return
+        }
+        let payload = Data(persistedValue.dropFirst(header))
+        switch Format(rawValue: persistedValue[persistedValue.startIndex + Self.magic.count]) {
+        case .raw:
+            self.init(payload)
+        case .lzfse:
+            guard let data = try? (payload as NSData).decompressed(using: .lzfse) else {
+                self.init(persistedValue)
+                return
+            }
+            self.init(data as Data)
+        case .none:
+            self.init(persistedValue)
+        }
+    }
+
+    var persistableValue: Data {
+        guard !data.isEmpty else { return Data() }
+        if data.count >= Self.compressionThreshold,
+           let compressed = try? (data as NSData).compressed(using: .lzfse),
+           compressed.length + Self.magic.count + 1 < data.count {
+            return Self.magic + [Format.lzfse.rawValue] + (compressed as Data)
+        }
+        return Self.magic + [Format.raw.rawValue] + data
+    }
+}
@@ -0,0 +1,55 @@
+import XCTest
+import RealmSwift
+@testable import Catalog
+
+@available(iOS 14.0, *)
+final class AttachmentDB: Object {
+    @Persisted(primaryKey: true) var id: String
+    @Persisted var payload: CompressedData
+}
+
+@available(iOS 14.0, *)
+final class CompressedDataTests: XCTestCase {
+
+    func testLargeValueIsStoredCompressed() {
+        let data = Data(repeating: 42, count: 64 * 1024)
+        let persisted = CompressedData(data).persistableValue
+
+        XCTAssertLessThan(persisted.count, data.count)
+        XCTAssertEqual(CompressedData(persistedValue: persisted).data, data)
+    }
+
+    func testSmallValueIsStoredAsIs() {
+        let data = Data([1, 2, 3])
+        let persisted = CompressedData(data).persistableValue
+
+        XCTAssertEqual(persisted.count, data.count + 5)
+        XCTAssertEqual(CompressedData(persistedValue: persisted).data, data)
+    }
+
+    func testEmptyValue() {
+        XCTAssertEqual(CompressedData(Data()).persistableValue, Data())
+        XCTAssertEqual(CompressedData(persistedValue: Data()).data, Data())
+    }
+
+    func testUntaggedValueIsReadAsIs() {
+        for legacy in [Data([0x00, 1, 2]), Data([0x01, 1, 2]), Data([0xFF, 1, 2])] {
+            XCTAssertEqual(CompressedData(persistedValue: legacy).data, legacy)
+        }
+    }
+
+    func testStoringInRealm() throws {
+        let realm = try Realm(configuration: .inMemory(name: name))
+        let data = Data(repeating: 7, count: 64 * 1024)
+
+        try realm.write {
+            let attachment = AttachmentDB()
+            attachment.id = "test"
+            attachment.payload = CompressedData(data)
+            realm.add(attachment)
+        }
+
+        let attachment = try realm.findObject(of: AttachmentDB.self, for: "test")
+        XCTAssertEqual(attachment.payload.data, data)
+    }
+}
@@ -0,0 +1,65 @@
+import XCTest
+@testable import Catalog
+
+@available(iOS 14.0, *)
+final class DatabaseMetricsTests: XCTestCase {
+
+    func testEmptyHistogram() {
+        let histogram = LatencyHistogram()
+
+        XCTAssertEqual(histogram.count, 0)
+        XCTAssertEqual(histogram.percentile(0.5), 0)
+    }
+
+    func testPercentilesAreWithinBucketPrecision() {
+        var histogram = LatencyHistogram()
+        // 1ms to 1000ms
+        for milliseconds in 1 ... 1000 {
+            histogram.record(nanoseconds: UInt64(milliseconds) * 1_000_000)
+        }
+
+        let snapshot = histogram.snapshot
+        XCTAssertEqual(snapshot.count, 1000)
+        XCTAssertEqual(snapshot.p50, 0.5, accuracy: 0.5 * 0.125)
+        XCTAssertEqual(snapshot.p99, 0.99, accuracy: 0.99 * 0.125)
+        XCTAssertEqual(snapshot.p999, 0.999, accuracy: 0.999 * 0.125)
+    }
+
+    func testSmallValuesAreExact() {
+        var histogram = LatencyHistogram()
+        histogram.record(nanoseconds: 3)
+
+        XCTAssertEqual(histogram.percentile(1), 0.000_000_003, accuracy: 1e-12)
+    }
+
+    func testSubMicrosecondValuesKeepPrecision() {
+        var histogram = LatencyHistogram()
+        histogram.record(nanoseconds: 1_900)
+
+        XCTAssertEqual(histogram.percentile(1), 0.000_001_9, accuracy: 0.000_001_9 * 0.125)
+    }
+
+    func testSignpostIntervalIsRecorded() async throws {
+        let database = try Database(configuration: .inMemory(name: name))
+        DatabaseMetrics.shared.reset()
+
+        try await database.createOrUpdate(UserDB.self, with: User(id: "test", name: ""))
+
+        let metrics = DatabaseMetrics.shared.snapshot()
+        XCTAssertEqual(metrics["Grouped write"]?.count, 1)
+        XCTAssertEqual(metrics["Commit"]?.count, 1)
+    }
+
+    func testReadsAreRecordedPerModelType() async throws {
+        let database = try Database(configuration: .inMemory(name: name))
+        try await database.createOrUpdate(UserDB.self, with: User(id: "test", name: ""))
+        DatabaseMetrics.shared.reset()
+
+        _ = try await database.read(UserDB.self, id: "test")
+        _ = try await database.readPage(UserDB.self, offset: 0, limit: 1)
+
+        let metrics = DatabaseMetrics.shared.snapshot()
+        XCTAssertEqual(metrics["Read UserDB"]?.count, 1)
+        XCTAssertEqual(metrics["Query UserDB"]?.count, 1)
+    }
+}
@@ -64,4 +64,168 @@ class DatabaseTests: XCTestCase {
         await fulfillment(of: [expectation], timeout: 1)
         XCTAssertEqual(nameEvents, ["Initial", "Changed"])
     }
+
+    func testConcurrentWritesAreAllCommitted() async throws {
+        let database = try Database(configuration: .inMemory(name: name))
+
+        try await withThrowingTaskGroup(of: Void.self) { group in
+            for index in 0 ..< 50 {
+                group.addTask {
+                    try await database.createOrUpdate(UserDB.self, with: User(id: "\(index)", name: "\(index)"))
+                }
+            }
+            try await group.waitForAll()
+        }
+
+        let count = try await database.realm.fetch { $0.objects(UserDB.self).count }
+        XCTAssertEqual(count, 50)
+    }
+
+    func testFailingWriteDoesntAffectGroupedWrites() async throws {
+        let database = try Database(configuration: .inMemory(name: name))
+        DatabaseMetrics.shared.reset()
+        let failed = expectation(description: "Failing write")
+        let succeeded = expectation(description: "Succeeding write")
+        var failingRuns = 0
+
+        // Queued from the database queue, so both writes are
+        // waiting on the queue before the commit is scheduled
+        DispatchQueue.database.async {
+            database.writer.write({ _ -> Void in
+                failingRuns += 1
+                throw NotFoundError()
+            }) { result in
+                if case .failure = result { failed.fulfill() }
+            }
+            database.writer.write({ realm -> Void in
+                let user = UserDB()
+                user.id = "test"
+                realm.add(user)
+            }) { result in
+                if case .success = result { succeeded.fulfill() }
+            }
+        }
+
+        await fulfillment(of: [failed, succeeded], timeout: 1)
+        // The rolled back attempt and the commit of the remaining write
+        XCTAssertEqual(DatabaseMetrics.shared.snapshot()["Grouped write"]?.count, 2)
+        XCTAssertEqual(DatabaseMetrics.shared.snapshot()["Commit"]?.count, 1)
+        XCTAssertEqual(failingRuns, 1)
+        let user = try await database.read(UserDB.self, id: "test")
+        XCTAssertEqual(user.id, "test")
+    }
+
+    func testCreateIsGroupedWrite() async throws {
+        let database = try Database(configuration: .inMemory(name: name))
+        DatabaseMetrics.shared.reset()
+        let created = expectation(description: "Create")
+
+        let cancellable = database
+            .create(UserDB.self, model: User(id: "test", name: ""))
+            .sink(receiveCompletion: { _ in created.fulfill() }, receiveValue: { })
+        _ = cancellable
+
+        await fulfillment(of: [created], timeout: 1)
+        XCTAssertEqual(DatabaseMetrics.shared.snapshot()["Grouped write"]?.count, 1)
+        let user = try await database.read(UserDB.self, id: "test")
+        XCTAssertEqual(user.id, "test")
+    }
+
+    func testBatchCreateOrUpdate() async throws {
+        let database = try Database(configuration: .inMemory(name: name))
+        try await database.createOrUpdate(UserDB.self, with: User(id: "1", name: "Initial"))
+
+        try await database.createOrUpdate(UserDB.self, with: [
+            User(id: "1", name: "Changed"),
+            User(id: "2", name: "Created"),
+            User(id: "2", name: "Created twice")
+        ])
+
+        let first = try await database.read(UserDB.self, id: "1")
+        let second = try await database.read(UserDB.self, id: "2")
+        XCTAssertEqual(first.name, "Changed")
+        XCTAssertEqual(second.name, "Created twice")
+    }
+
+    func testObserveWithCoalescingPublishesLatestChange() async throws {
+        let database = try Database(configuration: .inMemory(name: name))
+        try await database.createOrUpdate(UserDB.self, with: User(id: "test", name: "Initial"))
+        let expectation = self.expectation(description: "Name observer")
+
+        var nameEvents: [String] = []
+        let cancellable = database
+            .observe(dbModel: UserDB.self, id: "test", coalescingInterval: .milliseconds(500), mapping: \.asModel)
+            .sink {
+                nameEvents.append($0.name)
+                if $0.name == "Changed 3" { expectation.fulfill() }
+            }
+        _ = cancellable
+
+        for index in 1 ... 3 {
+            try await database.update(UserDB.self, with: User(id: "test", name: "Changed \(index)"))
+        }
+
+        await fulfillment(of: [expectation], timeout: 2)
+        XCTAssertEqual(nameEvents.first, "Initial")
+        XCTAssertEqual(nameEvents.last, "Changed 3")
+        // Without coalescing every commit is published: "Initial" and 3 changes
+        XCTAssertLessThan(nameEvents.count, 4)
+    }
+
+    func testObserveWithCoalescingSkipsDeletedObject() async throws {
+        let database = try Database(configuration: .inMemory(name: name))
+        try await database.createOrUpdate(UserDB.self, with: User(id: "test", name: "Initial"))
+
+        var nameEvents: [String] = []
+        let cancellable = database
+            .observe(dbModel: UserDB.self, id: "test", coalescingInterval: .milliseconds(300), mapping: \.asModel)
+            .sink { nameEvents.append($0.name) }
+        _ = cancellable
+
+        try await database.update(UserDB.self, with: User(id: "test", name: "Changed"))
+        try await database.write { realm in
+            realm.delete(try realm.findObject(of: UserDB.self, for: "test"))
+        }
+        try await Task.sleep(nanoseconds: 600_000_000)
+
+        XCTAssertEqual(nameEvents, ["Initial"])
+    }
+
+    func testBatchCreateOrUpdateWithoutModelsDoesntWrite() async throws {
+        let database = try Database(configuration: .inMemory(name: name))
+        DatabaseMetrics.shared.reset()
+
+        try await database.createOrUpdate(UserDB.self, with: [User]())
+
+        XCTAssertNil(DatabaseMetrics.shared.snapshot()["Grouped write"])
+    }
+
+    func testReadPage() async throws {
+        let database = try Database(configuration: .inMemory(name: name))
+        try await database.createOrUpdate(UserDB.self, with: (0 ..< 10).map { User(id: "\($0)", name: "\($0)") })
+
+        let page = try await database.readPage(
+            UserDB.self,
+            sortedBy: [RealmSwift.SortDescriptor(keyPath: "id")],
+            offset: 8,
+            limit: 5
+        )
+        let pastEnd = try await database.readPage(UserDB.self, offset: 10, limit: 5)
+
+        XCTAssertEqual(page.map(\.id), ["8", "9"])
+        XCTAssertTrue(pastEnd.isEmpty)
+    }
+
+    func testReadPageWithInvalidBounds() async throws {
+        let database = try Database(configuration: .inMemory(name: name))
+        try await database.createOrUpdate(UserDB.self, with: (0 ..< 3).map { User(id: "\($0)", name: "\($0)") })
+
+        let negativeOffset = try await database.readPage(UserDB.self, offset: -1, limit: 2)
+        let zeroLimit = try await database.readPage(UserDB.self, offset: 0, limit: 0)
+        let hugeLimit = try await database.readPage(UserDB.self, offset: 1, limit: .max)
+
+        XCTAssertTrue(negativeOffset.isEmpty)
+        XCTAssertTrue(zeroLimit.isEmpty)
+        XCTAssertEqual(hugeLimit.count, 2)
+    }
 }
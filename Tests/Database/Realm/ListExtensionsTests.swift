@@ -20,4 +20,25 @@ final class ListExtensionsTests: XCTestCase {
         XCTAssertEqual(list.count, 2)
         XCTAssertFalse(list.contains(toRemove))
     }
+
+    func testRemoveDuplicatesFromRealmList() {
+        let list = List([1, 2, 1, 3, 1])
+
+        list.remove(items: [1, 1, 3])
+        XCTAssertEqual(Array(list), [2, 1])
+    }
+
+    func testRemoveMissingItemFromRealmList() {
+        let list = List([1, 2])
+
+        list.remove(items: [3])
+        XCTAssertEqual(Array(list), [1, 2])
+    }
+
+    func testAssignToRealmList() {
+        let list = List([1, 2])
+
+        list.assign([3, 4, 5])
+        XCTAssertEqual(Array(list), [3, 4, 5])
+    }
 }